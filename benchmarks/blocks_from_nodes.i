@@ -0,0 +1,11 @@
+# BlockFromNodesGeneratorFromFile on the synthetic node lists, used after synthetic_mesh.i
+
+[Mesh]
+  [blocks]
+    type = BlockFromNodesGeneratorFromFile
+    input = data
+    file_name = ${file_base}_nodes.csv
+    block_name_column_index = 2
+    node_offset_column_index = 3
+  []
+[]
@@ -0,0 +1,10 @@
+# BlocksFromSideSetsGeneratorFromFile on the synthetic sidesets, used after synthetic_mesh.i
+
+[Mesh]
+  [blocks]
+    type = BlocksFromSideSetsGeneratorFromFile
+    input = data
+    file_name = ${file_base}_sidesets.csv
+    block_name_column_index = 2
+  []
+[]
@@ -0,0 +1,93 @@
+# Checks that PorousFlowHydraulicPropertiesAllBlocks with a single permeability column gives the
+# same porosity, permeability and solution as PorousFlowPorosityAllBlocks and
+# PorousFlowPermeabilityAllBlocks reading the same columns. Used with solve.i and either
+# materials_all_blocks.i or materials_hydraulic.i; the check suite of run_benchmarks.py runs both
+# and compares the ${out_base}_check_*.csv files they write.
+
+[AuxVariables]
+  [porosity]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [kxx]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [kxy]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [kyy]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [kzz]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [porosity]
+    type = MaterialRealAux
+    variable = porosity
+    property = PorousFlow_porosity_qp
+    execute_on = TIMESTEP_END
+  []
+  [kxx]
+    type = MaterialRealTensorValueAux
+    variable = kxx
+    property = PorousFlow_permeability_qp
+    row = 0
+    column = 0
+    execute_on = TIMESTEP_END
+  []
+  [kxy]
+    type = MaterialRealTensorValueAux
+    variable = kxy
+    property = PorousFlow_permeability_qp
+    row = 0
+    column = 1
+    execute_on = TIMESTEP_END
+  []
+  [kyy]
+    type = MaterialRealTensorValueAux
+    variable = kyy
+    property = PorousFlow_permeability_qp
+    row = 1
+    column = 1
+    execute_on = TIMESTEP_END
+  []
+  [kzz]
+    type = MaterialRealTensorValueAux
+    variable = kzz
+    property = PorousFlow_permeability_qp
+    row = 2
+    column = 2
+    execute_on = TIMESTEP_END
+  []
+[]
+
+[VectorPostprocessors]
+  # The nodal porosity only enters the solution, through the mass time derivative
+  [elements]
+    type = ElementValueSampler
+    variable = 'porosity kxx kxy kyy kzz'
+    sort_by = id
+    execute_on = TIMESTEP_END
+  []
+  [nodes]
+    type = NodalValueSampler
+    variable = pp
+    sort_by = id
+    execute_on = TIMESTEP_END
+  []
+[]
+
+[Outputs]
+  [check]
+    type = CSV
+    file_base = ${out_base}_check
+    execute_on = TIMESTEP_END
+  []
+[]
@@ -0,0 +1,20 @@
+# Porosity and permeability of every block from the synthetic property table, used with solve.i
+
+[Materials]
+  [porosity_qp]
+    type = PorousFlowPorosityAllBlocks
+    file_name = ${file_base}_properties.csv
+    col_index = 1
+  []
+  [porosity_nodal]
+    type = PorousFlowPorosityAllBlocks
+    file_name = ${file_base}_properties.csv
+    col_index = 1
+    at_nodes = true
+  []
+  [permeability]
+    type = PorousFlowPermeabilityAllBlocks
+    file_name = ${file_base}_properties.csv
+    col_index = 2
+  []
+[]
@@ -0,0 +1,18 @@
+# Constant porosity and permeability, used with solve.i as the reference the table materials are
+# compared with: the difference in assembly time is the time spent looking up the tables
+
+[Materials]
+  [porosity_qp]
+    type = PorousFlowPorosityConst
+    porosity = 0.1
+  []
+  [porosity_nodal]
+    type = PorousFlowPorosityConst
+    porosity = 0.1
+    at_nodes = true
+  []
+  [permeability]
+    type = PorousFlowPermeabilityConst
+    permeability = '1e-12 0 0 0 1e-12 0 0 0 1e-12'
+  []
+[]
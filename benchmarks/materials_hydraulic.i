@@ -0,0 +1,17 @@
+# Porosity and permeability of every block from the synthetic property table, given by the
+# combined material, used with solve.i
+
+[Materials]
+  [hydraulic_qp]
+    type = PorousFlowHydraulicPropertiesAllBlocks
+    file_name = ${file_base}_properties.csv
+    porosity_col_index = 1
+    permeability_col_indices = 2
+  []
+  [hydraulic_nodal]
+    type = PorousFlowHydraulicPropertiesAllBlocks
+    file_name = ${file_base}_properties.csv
+    porosity_col_index = 1
+    at_nodes = true
+  []
+[]
@@ -0,0 +1,619 @@
+#!/usr/bin/env python3
+"""
+Runs the z01App benchmark suites and collects their results in one JSON file.
+
+Every case first writes the synthetic data with synthetic_mesh.i, then runs the same mesh through
+the inputs of the case, with as many processes and the same mesh type. The perf graph, memory and
+lower-d block report of every run are recorded together with its wall time. With --baseline-exec
+every case is run a second time with another build, leaving out the parameters that only the
+current build has, so that two versions can be compared case by case.
+
+    ./run_benchmarks.py --exec ../z01-opt --suite generators --ranks 1 4 16
+"""
+
+import argparse
+import csv
+import glob
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+SUITES = {}
+
+
+def suite(function):
+    """Registers a function yielding the cases of a suite under the name of the function"""
+    SUITES[function.__name__] = function
+    return function
+
+
+class Case:
+    """One run of the application on the synthetic data"""
+
+    def __init__(self, suite, inputs, params, ranks, distributed, mesh_args=(), args=(),
+                 new_args=(), threads=1, baseline=True):
+        self.suite = suite
+        # Input files read after synthetic_mesh.i
+        self.inputs = list(inputs)
+        # What the case varies, recorded with the results
+        self.params = dict(params)
+        self.ranks = ranks
+        self.distributed = distributed
+        # Command line parameters of synthetic_mesh.i
+        self.mesh_args = list(mesh_args)
+        # Command line parameters of the other inputs
+        self.args = list(args)
+        # Command line parameters the baseline build may not have
+        self.new_args = list(new_args)
+        self.threads = threads
+        # Whether to run the case with the baseline build, which new_args may make pointless
+        self.baseline = baseline
+
+    def name(self):
+        parts = [self.suite] + ['%s-%s' % item for item in sorted(self.params.items())]
+        parts += ['np%d' % self.ranks, 'distributed' if self.distributed else 'replicated']
+        if self.threads > 1:
+            parts.append('nt%d' % self.threads)
+        return '_'.join(parts)
+
+    def record(self):
+        return {'suite': self.suite, 'case': self.name(), 'params': self.params,
+                'ranks': self.ranks, 'threads': self.threads,
+                'mesh': 'distributed' if self.distributed else 'replicated'}
+
+
+def elements_per_side(num_elements):
+    """The number of elements along each side of a cube of about num_elements HEX8 elements"""
+    return max(1, round(float(num_elements) ** (1.0 / 3.0)))
+
+
+@suite
+def generators(opts):
+    """Each FromFile generator followed by a short solve with the table and constant materials"""
+    for size in opts.sizes:
+        for generator in ('sidesets', 'nodes'):
+            for materials in ('all_blocks', 'const'):
+                for ranks in opts.ranks:
+                    for mesh in opts.meshes:
+                        yield Case('generators',
+                                   ['blocks_from_%s.i' % generator, 'solve.i',
+                                    'materials_%s.i' % materials],
+                                   dict(elements=size, generator=generator, materials=materials),
+                                   ranks,
+                                   mesh == 'distributed',
+                                   mesh_args=['n=%d' % elements_per_side(size)],
+                                   new_args=['Mesh/blocks/verbose=true'])
+
+
+@suite
+def scaling(opts):
+    """
+    Strong and weak scaling of BlocksFromSideSetsGeneratorFromFile on a distributed mesh, with
+    both boundary element exchanges, adding the blocks in bulk and one sideset at a time. Strong
+    scaling keeps the largest size for every number of processes, weak scaling gives each process
+    the smallest size. The baseline build only has the sequential all_ranks variant.
+    """
+    for mode in ('strong', 'weak'):
+        for ranks in opts.ranks:
+            size = max(opts.sizes) if mode == 'strong' else min(opts.sizes) * ranks
+            for exchange in ('all_ranks', 'neighbors'):
+                for bulk in ('true', 'false'):
+                    yield Case('scaling',
+                               ['blocks_from_sidesets.i', 'solve.i', 'materials_const.i'],
+                               dict(scaling=mode, elements=size, exchange=exchange, bulk=bulk),
+                               ranks,
+                               True,
+                               mesh_args=['n=%d' % elements_per_side(size),
+                                          'num_blocks=%d' % opts.num_blocks],
+                               args=['num_steps=1'],
+                               new_args=['Mesh/blocks/verbose=true',
+                                         'Mesh/blocks/bulk=' + bulk,
+                                         'Mesh/blocks/boundary_element_exchange=' + exchange],
+                               baseline=exchange == 'all_ranks' and bulk == 'false')
+
+
+@suite
+def tables(opts):
+    """
+    Startup time and memory of the table materials on a mesh with a table of --table-rows blocks,
+    compared with constant materials, with one and several threads: every thread has its own
+    material objects, which share one table
+    """
+    size = max(min(opts.sizes), opts.table_rows)
+    for materials in ('all_blocks', 'const'):
+        for threads in opts.threads:
+            for ranks in opts.ranks:
+                for mesh in opts.meshes:
+                    yield Case('tables',
+                               ['solve.i', 'materials_%s.i' % materials],
+                               dict(elements=size, rows=opts.table_rows, materials=materials),
+                               ranks,
+                               mesh == 'distributed',
+                               mesh_args=['n=%d' % elements_per_side(size),
+                                          'num_subdomains=%d' % opts.table_rows],
+                               args=['num_steps=1'],
+                               threads=threads)
+
+
+@suite
+def jacobian(opts):
+    """
+    Material evaluation time per Jacobian on a mesh of --jacobian-blocks blocks, with the porosity
+    and permeability tables, the combined table material and constant materials
+    """
+    for size in opts.sizes:
+        for materials in ('all_blocks', 'hydraulic', 'const'):
+            for ranks in opts.ranks:
+                for mesh in opts.meshes:
+                    yield Case('jacobian',
+                               ['solve.i', 'materials_%s.i' % materials],
+                               dict(elements=size, blocks=opts.jacobian_blocks,
+                                    materials=materials),
+                               ranks,
+                               mesh == 'distributed',
+                               mesh_args=['n=%d' % elements_per_side(size),
+                                          'num_subdomains=%d' % opts.jacobian_blocks],
+                               baseline=materials != 'hydraulic')
+
+
+@suite
+def parser(opts):
+    """
+    The node list parser micro-benchmark, csv_parse_benchmark, comparing the getline loop that
+    BlockFromNodesGeneratorFromFile used to have with BlockNodeLists::read, which it now calls,
+    on the node lists of the largest mesh, with a side of every element listed. Needs
+    --parser-exec.
+    """
+    if not opts.parser_exec:
+        print('Skipping the parser suite, which needs --parser-exec')
+        return
+    size = max(opts.sizes)
+    yield Case('parser',
+               [],
+               dict(elements=size, blocks=opts.num_blocks),
+               1,
+               False,
+               mesh_args=['n=%d' % elements_per_side(size),
+                          'num_blocks=%d' % opts.num_blocks,
+                          'element_period=1'],
+               baseline=False)
+
+
+@suite
+def check(opts):
+    """
+    Whether PorousFlowHydraulicPropertiesAllBlocks with one permeability column gives the same
+    porosity, permeability and solution as PorousFlowPorosityAllBlocks and
+    PorousFlowPermeabilityAllBlocks, on the smallest mesh. A difference fails the run.
+    """
+    size = min(opts.sizes)
+    for materials in ('all_blocks', 'hydraulic'):
+        for ranks in opts.ranks:
+            for mesh in opts.meshes:
+                yield Case('check',
+                           ['solve.i', 'hydraulic_check.i', 'materials_%s.i' % materials],
+                           dict(elements=size, materials=materials),
+                           ranks,
+                           mesh == 'distributed',
+                           mesh_args=['n=%d' % elements_per_side(size)],
+                           args=['num_steps=1'],
+                           baseline=False)
+
+
+def command(opts, exe, case, inputs, args):
+    cmd = [opts.mpiexec, '-n', str(case.ranks), exe, '-i']
+    cmd += [os.path.join(HERE, input_file) for input_file in inputs]
+    if case.distributed:
+        cmd.append('--distributed-mesh')
+    if case.threads > 1:
+        cmd.append('--n-threads=%d' % case.threads)
+    return cmd + args
+
+
+def run(opts, cmd, log_name):
+    """Runs cmd with its output in log_name, returning the exit code and the wall time"""
+    if opts.dry_run:
+        print(' '.join(cmd))
+        return 0, 0.0
+    start = time.perf_counter()
+    with open(log_name, 'w') as log:
+        returncode = subprocess.call(cmd, stdout=log, stderr=subprocess.STDOUT)
+    return returncode, time.perf_counter() - start
+
+
+def perf_graph(data):
+    """
+    The total time, including the sections called from it, and the number of calls of every
+    section of the perf graphs in data, summed over the sections it is called from
+    """
+    sections = {}
+
+    def is_node(value):
+        return isinstance(value, dict) and 'num_calls' in value and 'time' in value
+
+    def add(name, node):
+        total = node['time']
+        for child_name, child in node.items():
+            if is_node(child):
+                total += add(child_name, child)
+        entry = sections.setdefault(name, {'time': 0.0, 'calls': 0})
+        entry['time'] += total
+        entry['calls'] += node['num_calls']
+        return total
+
+    def find(value):
+        if isinstance(value, dict):
+            for name, child in value.items():
+                if is_node(child):
+                    add(name, child)
+                else:
+                    find(child)
+        elif isinstance(value, list):
+            for child in value:
+                find(child)
+
+    find(data)
+    return sections
+
+
+def read_json(out_base):
+    """The perf graph, slowest process first, and the memory use written by solve.i"""
+    sections = {}
+    memory = {}
+    for file_name in sorted(glob.glob(out_base + '*.json*')):
+        with open(file_name) as f:
+            data = json.load(f)
+        # Processes may write their own file; keep the slowest of each section
+        for name, entry in perf_graph(data).items():
+            if name not in sections or entry['time'] > sections[name]['time']:
+                sections[name] = entry
+        steps = data.get('time_steps') or [{}]
+        last = steps[-1]
+        if 'peak_rss' in last:
+            memory['peak_rss'] = last['peak_rss'].get('value')
+        if 'rank_memory' in last:
+            memory['rank_physical_mem'] = last['rank_memory'].get('physical_mem')
+    return sections, memory
+
+
+def read_check(out_base):
+    """The last values of the samplers of hydraulic_check.i, by sampler and column"""
+    values = {}
+    for name in ('elements', 'nodes'):
+        file_names = sorted(file_name for file_name in
+                            glob.glob('%s_check_%s_*.csv' % (out_base, name))
+                            if not file_name.endswith('_time.csv'))
+        if not file_names:
+            continue
+        with open(file_names[-1], newline='') as f:
+            columns = {}
+            for row in csv.DictReader(f):
+                for column, value in row.items():
+                    columns.setdefault(column, []).append(float(value))
+        values[name] = columns
+    return values
+
+
+LOWER_D_REPORT = re.compile(
+    r'added (\d+) lower-d elements in (\d+) blocks from (\d+) sidesets in (\d+) passes; (\d+) '
+    r'prepare_for_use calls took (\S+) s(?:; exchanged (\d+) bytes of boundary data \((\w+)\) '
+    r'over (\d+) processes in (\S+) s)?')
+
+
+def read_log(log_name):
+    """The lower-d block report that the generators print when verbose"""
+    if not os.path.exists(log_name):
+        return None
+    with open(log_name, errors='replace') as log:
+        match = LOWER_D_REPORT.search(log.read())
+    if not match:
+        return None
+    values = match.groups()
+    report = {'elements_added': int(values[0]), 'blocks': int(values[1]),
+              'sidesets': int(values[2]), 'passes': int(values[3]),
+              'prepare_for_use_calls': int(values[4]), 'prepare_for_use_time': float(values[5])}
+    if values[6] is not None:
+        report.update({'bytes_exchanged': int(values[6]), 'exchange': values[7],
+                       'exchange_time': float(values[9])})
+    return report
+
+
+def section(sections, name):
+    """Time and calls of the sections called name, whatever object they belong to"""
+    time_total, calls = 0.0, 0
+    for key, entry in sections.items():
+        if key == name or key.endswith('::' + name):
+            time_total += entry['time']
+            calls += entry['calls']
+    return time_total, calls
+
+
+def summarise(result):
+    sections = result['perf']
+    summary = {'wall_time': result['wall_time'], 'peak_rss': result['memory'].get('peak_rss')}
+    for name in ('addLowerDBlocks', 'readFile', 'computeResidualInternal',
+                 'computeJacobianInternal', 'BlockPropertyTable::load'):
+        time_total, calls = section(sections, name)
+        summary[name] = {'time': time_total, 'calls': calls}
+    report = result['lower_d']
+    if report:
+        summary['prepare_for_use_calls'] = report['prepare_for_use_calls']
+        summary['bytes_exchanged'] = report.get('bytes_exchanged')
+        summary['exchange_time'] = report.get('exchange_time')
+    else:
+        summary['prepare_for_use_calls'] = (section(sections, 'prepareInput')[1] +
+                                            section(sections, 'prepareOutput')[1]) or None
+    return summary
+
+
+def derive(results):
+    """
+    What the table materials cost over constant ones in the same case: the time spent evaluating
+    them (residual and Jacobian time), the rest of the run time, mostly reading the table, and the
+    memory of every process
+    """
+    def key(result):
+        params = dict(result['params'])
+        params.pop('materials', None)
+        return (result['build'], result['suite'], json.dumps(params, sort_keys=True),
+                result['ranks'], result['threads'], result['mesh'])
+
+    def assembly_time(result):
+        return (result['summary']['computeResidualInternal']['time'] +
+                result['summary']['computeJacobianInternal']['time'])
+
+    reference = {key(r): r for r in results
+                 if r['params'].get('materials') == 'const' and r['returncode'] == 0}
+    for result in results:
+        const = reference.get(key(result))
+        if result['params'].get('materials', 'const') != 'const' and const and \
+                result['returncode'] == 0:
+            summary = result['summary']
+            summary['material_time'] = assembly_time(result) - assembly_time(const)
+            jacobian_calls = summary['computeJacobianInternal']['calls']
+            if jacobian_calls:
+                summary['material_time_per_jacobian'] = (
+                    summary['computeJacobianInternal']['time'] -
+                    const['summary']['computeJacobianInternal']['time'] *
+                    jacobian_calls / max(const['summary']['computeJacobianInternal']['calls'], 1)
+                ) / jacobian_calls
+            summary['material_setup_time'] = (result['wall_time'] - const['wall_time'] -
+                                              summary['material_time'])
+            memory = result['memory'].get('rank_physical_mem')
+            const_memory = const['memory'].get('rank_physical_mem')
+            if memory and const_memory and len(memory) == len(const_memory):
+                summary['material_rank_memory'] = [m - c for m, c in zip(memory, const_memory)]
+
+    derive_scaling(results)
+    return derive_check(results)
+
+
+def derive_scaling(results):
+    """
+    The parallel efficiency of the generator in the scaling suite, relative to the fewest
+    processes run: t_1 p_1 / (t_p p) for strong scaling and t_1 / t_p for weak scaling
+    """
+    def key(result):
+        params = dict(result['params'])
+        params.pop('elements')
+        return (result['build'], json.dumps(params, sort_keys=True))
+
+    series = {}
+    for result in results:
+        if result['suite'] == 'scaling' and result['returncode'] == 0:
+            series.setdefault(key(result), []).append(result)
+    for runs in series.values():
+        first = min(runs, key=lambda result: result['ranks'])
+        reference = first['summary']['addLowerDBlocks']['time'] * first['ranks']
+        for result in runs:
+            time_p = result['summary']['addLowerDBlocks']['time']
+            if not time_p:
+                continue
+            if result['params']['scaling'] == 'strong':
+                result['summary']['efficiency'] = reference / (time_p * result['ranks'])
+            else:
+                result['summary']['efficiency'] = reference / first['ranks'] / time_p
+
+
+def max_difference(reference, values):
+    """
+    The largest relative difference between the sampled values of two runs, or None if they did
+    not sample the same columns and points
+    """
+    if not reference or reference.keys() != values.keys():
+        return None
+    difference = 0.0
+    for name, columns in reference.items():
+        if columns.keys() != values[name].keys():
+            return None
+        for column, column_values in columns.items():
+            if len(column_values) != len(values[name][column]):
+                return None
+            for a, b in zip(column_values, values[name][column]):
+                scale = max(abs(a), abs(b))
+                if scale:
+                    difference = max(difference, abs(a - b) / scale)
+    return difference
+
+
+def derive_check(results, tolerance=1e-10):
+    """
+    Compares the samplers of each check run with the combined material to those of the same run
+    with the two table materials, recording the largest relative difference. Returns the names
+    of the cases that differ.
+    """
+    def key(result):
+        params = dict(result['params'])
+        params.pop('materials')
+        return (result['build'], json.dumps(params, sort_keys=True), result['ranks'],
+                result['mesh'])
+
+    runs = {}
+    for result in results:
+        if result['suite'] == 'check' and result['returncode'] == 0 and 'check' in result:
+            runs.setdefault(key(result), {})[result['params']['materials']] = result
+
+    failed = []
+    for pair in runs.values():
+        if 'all_blocks' not in pair or 'hydraulic' not in pair:
+            continue
+        difference = max_difference(pair['all_blocks']['check'], pair['hydraulic']['check'])
+        matches = difference is not None and difference <= tolerance
+        pair['hydraulic']['summary']['max_relative_difference'] = difference
+        pair['hydraulic']['summary']['matches'] = matches
+        if not matches:
+            failed.append(pair['hydraulic']['case'])
+
+    # The sampled values are only needed for the comparison
+    for result in results:
+        result.pop('check', None)
+    return failed
+
+
+def run_case(opts, case, build, exe, data_dirs):
+    record = case.record()
+    record['build'] = build
+    run_dir = os.path.join(opts.workdir, case.name(), build)
+    os.makedirs(run_dir, exist_ok=True)
+
+    # The data only depends on the mesh, so cases on the same mesh share it. It is always written
+    # by the current build, and with the processes and mesh type of the run reading it.
+    data_key = (tuple(case.mesh_args), case.ranks, case.distributed)
+    if data_key not in data_dirs:
+        data_dir = os.path.join(opts.workdir, 'data_%d' % len(data_dirs))
+        os.makedirs(data_dir, exist_ok=True)
+        args = case.mesh_args + ['file_base=' + os.path.join(data_dir, 'synthetic'),
+                                 '--mesh-only', os.path.join(data_dir, 'mesh.e')]
+        returncode, _ = run(opts, command(opts, opts.exec, case, ['synthetic_mesh.i'], args),
+                            os.path.join(data_dir, 'data.log'))
+        if returncode:
+            sys.exit('Writing the synthetic data failed, see ' + data_dir)
+        if not opts.keep and os.path.exists(os.path.join(data_dir, 'mesh.e')):
+            os.remove(os.path.join(data_dir, 'mesh.e'))
+        data_dirs[data_key] = data_dir
+    file_base = os.path.join(data_dirs[data_key], 'synthetic')
+
+    if case.suite == 'parser':
+        return run_parser(opts, record, file_base + '_nodes.csv', run_dir)
+
+    out_base = os.path.join(run_dir, 'benchmark')
+    args = case.mesh_args + case.args + ['file_base=' + file_base, 'out_base=' + out_base]
+    if build == 'current':
+        args += case.new_args
+    log_name = os.path.join(run_dir, 'run.log')
+    record['command'] = command(opts, exe, case, ['synthetic_mesh.i'] + case.inputs, args)
+    record['returncode'], record['wall_time'] = run(opts, record['command'], log_name)
+
+    record['perf'], record['memory'] = ({}, {}) if opts.dry_run else read_json(out_base)
+    record['lower_d'] = None if opts.dry_run else read_log(log_name)
+    if case.suite == 'check' and not opts.dry_run:
+        record['check'] = read_check(out_base)
+    record['summary'] = summarise(record)
+    if not opts.keep and not opts.dry_run:
+        for file_name in glob.glob(os.path.join(run_dir, '*.e*')):
+            os.remove(file_name)
+    return record
+
+
+def run_parser(opts, record, file_name, run_dir):
+    """Runs csv_parse_benchmark on file_name, which prints one JSON object per parser"""
+    log_name = os.path.join(run_dir, 'run.log')
+    record['command'] = [opts.parser_exec, file_name, '2', '3', str(opts.parser_repeats)]
+    record['returncode'], record['wall_time'] = run(opts, record['command'], log_name)
+    record['parsers'] = {}
+    if not opts.dry_run:
+        with open(log_name, errors='replace') as log:
+            for line in log:
+                if line.startswith('{'):
+                    result = json.loads(line)
+                    record['parsers'][result['parser']] = result
+    record['summary'] = {name: result['best'] for name, result in record['parsers'].items()}
+    if record['summary'].get('legacy') and record['summary'].get('mapped'):
+        record['summary']['speedup'] = record['summary']['legacy'] / record['summary']['mapped']
+    return record
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--exec', required=True, help='The application to benchmark')
+    parser.add_argument('--baseline-exec',
+                        help='Another build of the application to run every case with')
+    parser.add_argument('--suite', nargs='+', choices=sorted(SUITES), default=sorted(SUITES),
+                        help='The suites to run (default: all)')
+    parser.add_argument('--ranks', nargs='+', type=int, default=[1, 4, 16],
+                        help='The numbers of MPI processes (default: 1 4 16)')
+    parser.add_argument('--meshes', nargs='+', choices=['replicated', 'distributed'],
+                        default=['replicated', 'distributed'],
+                        help='The mesh types, distributed meaning --distributed-mesh')
+    parser.add_argument('--sizes', nargs='+', type=float, default=[1e4, 1e5, 1e6, 1e7],
+                        help='The approximate numbers of elements (default: 1e4 1e5 1e6 1e7)')
+    parser.add_argument('--num-blocks', type=int, default=64,
+                        help='The number of sidesets of the scaling suite (default: 64)')
+    parser.add_argument('--jacobian-blocks', type=int, default=256,
+                        help='The number of blocks of the jacobian suite (default: 256)')
+    parser.add_argument('--table-rows', type=int, default=10000,
+                        help='The number of blocks in the table of the tables suite '
+                        '(default: 10000)')
+    parser.add_argument('--threads', nargs='+', type=int, default=[1, 4],
+                        help='The numbers of threads of the tables suite (default: 1 4)')
+    parser.add_argument('--parser-exec', help='The csv_parse_benchmark program of the parser suite')
+    parser.add_argument('--parser-repeats', type=int, default=5,
+                        help='How many times the parser suite reads the file (default: 5)')
+    parser.add_argument('--mpiexec', default='mpiexec', help='The MPI launcher')
+    parser.add_argument('--workdir', default='benchmark_runs',
+                        help='Where to run the cases (default: benchmark_runs)')
+    parser.add_argument('--output', default='benchmark_results.json',
+                        help='The results file (default: benchmark_results.json)')
+    parser.add_argument('--keep', action='store_true', help='Keep the mesh files of the runs')
+    parser.add_argument('--dry-run', action='store_true',
+                        help='Print the commands instead of running them')
+    opts = parser.parse_args()
+    opts.sizes = [int(size) for size in opts.sizes]
+    opts.workdir = os.path.abspath(opts.workdir)
+    opts.exec = os.path.abspath(opts.exec)
+    if opts.baseline_exec:
+        opts.baseline_exec = os.path.abspath(opts.baseline_exec)
+    if opts.parser_exec:
+        opts.parser_exec = os.path.abspath(opts.parser_exec)
+
+    builds = [('current', opts.exec)]
+    if opts.baseline_exec:
+        builds.append(('baseline', opts.baseline_exec))
+
+    results = []
+    data_dirs = {}
+    for name in opts.suite:
+        for case in SUITES[name](opts):
+            for build, exe in builds:
+                if build == 'baseline' and not case.baseline:
+                    continue
+                result = run_case(opts, case, build, exe, data_dirs)
+                print('%-80s %-8s %s' % (case.name(), build,
+                                         'failed' if result['returncode'] else
+                                         '%.2f s' % result['wall_time']))
+                results.append(result)
+    failed_checks = derive(results)
+    for name in failed_checks:
+        print('%s: the combined material does not match the two table materials' % name)
+
+    if not opts.dry_run:
+        with open(opts.output, 'w') as f:
+            json.dump({'exec': opts.exec, 'baseline_exec': opts.baseline_exec,
+                       'host': platform.node(), 'date': time.strftime('%Y-%m-%dT%H:%M:%S'),
+                       'results': results}, f, indent=1)
+    if not opts.keep and not opts.dry_run:
+        for data_dir in data_dirs.values():
+            shutil.rmtree(data_dir, ignore_errors=True)
+    return 1 if failed_checks or any(result['returncode'] for result in results) else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
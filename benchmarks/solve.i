@@ -0,0 +1,126 @@
+# Short single-phase, fully saturated PorousFlow solve on every block of the benchmark mesh. The
+# porosity and permeability come from one of the materials_*.i files. The perf graph, the peak
+# memory of the largest process and the memory of every process are written to ${out_base}.json.
+
+num_steps = 2
+out_base = benchmark
+
+[GlobalParams]
+  PorousFlowDictator = dictator
+[]
+
+[Variables]
+  [pp]
+    initial_condition = 1e6
+  []
+[]
+
+[BCs]
+  [inlet]
+    type = DirichletBC
+    variable = pp
+    boundary = left
+    value = 2e6
+  []
+[]
+
+[Kernels]
+  [mass]
+    type = PorousFlowFullySaturatedMassTimeDerivative
+    variable = pp
+  []
+  [flux]
+    type = PorousFlowFullySaturatedDarcyBase
+    variable = pp
+    gravity = '0 0 0'
+  []
+[]
+
+[UserObjects]
+  [dictator]
+    type = PorousFlowDictator
+    porous_flow_vars = pp
+    number_fluid_phases = 1
+    number_fluid_components = 1
+  []
+[]
+
+[FluidProperties]
+  [water]
+    type = SimpleFluidProperties
+  []
+[]
+
+[Materials]
+  [temperature]
+    type = PorousFlowTemperature
+  []
+  [saturation]
+    type = PorousFlow1PhaseFullySaturated
+    porepressure = pp
+  []
+  [massfrac]
+    type = PorousFlowMassFraction
+  []
+  [fluid]
+    type = PorousFlowSingleComponentFluid
+    fp = water
+    phase = 0
+  []
+  [biot_modulus]
+    type = PorousFlowConstantBiotModulus
+    biot_coefficient = 0.8
+    solid_bulk_compliance = 2e-7
+    fluid_bulk_modulus = 1e7
+  []
+[]
+
+[Postprocessors]
+  [peak_rss]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    report_peak_value = true
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[VectorPostprocessors]
+  [rank_memory]
+    type = VectorMemoryUsage
+    report_peak_value = true
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Reporters]
+  [perf_graph]
+    type = PerfGraphReporter
+    execute_on = FINAL
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  dt = 1e3
+  num_steps = ${num_steps}
+  nl_abs_tol = 1e-6
+[]
+
+[Outputs]
+  [json]
+    type = JSON
+    file_base = ${out_base}
+    execute_on = FINAL
+  []
+[]
@@ -0,0 +1,32 @@
+# Synthetic mesh and data files shared by the benchmarks: a cube of n^3 HEX8 elements spread over
+# num_subdomains subdomains, with num_blocks sidesets and node lists written to ${file_base}_*.csv.
+# The FromFile generators read their file when they are constructed, before any mesh is
+# generated, so run_benchmarks.py first runs this file alone with --mesh-only, with the same
+# processes and mesh type, to write the files the benchmark then reads.
+
+n = 22
+num_subdomains = 8
+num_blocks = 16
+element_period = 10
+file_base = synthetic
+
+[Mesh]
+  # The node lists hold node ids, which must not change between the two runs
+  allow_renumbering = false
+
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = ${n}
+    ny = ${n}
+    nz = ${n}
+  []
+  [data]
+    type = SyntheticBlockDataGenerator
+    input = cube
+    num_subdomains = ${num_subdomains}
+    num_blocks = ${num_blocks}
+    element_period = ${element_period}
+    file_base = ${file_base}
+  []
+[]
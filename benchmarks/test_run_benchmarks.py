@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+Tests of run_benchmarks.py that need neither MOOSE nor MPI: the parsing of what the application
+writes, the derived results, and whole runs of the driver with stand-in executables.
+
+    python3 -m unittest -v test_run_benchmarks
+"""
+
+import json
+import os
+import stat
+import subprocess
+import sys
+import tempfile
+import unittest
+
+import run_benchmarks
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# Launches the command after "-n <ranks>" in place of mpiexec
+FAKE_MPIEXEC = """\
+#!/bin/sh
+shift 2
+exec "$@"
+"""
+
+# Stands in for the application: --mesh-only writes the data files, other runs write the JSON of
+# solve.i, the CSV files of hydraulic_check.i and, when verbose, the lower-d block report. With
+# FAKE_MISMATCH set, the combined material samples another porosity.
+FAKE_APP = """\
+#!/usr/bin/env python3
+import json, os, sys
+args = sys.argv[1:]
+params = dict(arg.split('=', 1) for arg in args if '=' in arg and not arg.startswith('-'))
+inputs = [arg for arg in args if arg.endswith('.i')]
+if '--mesh-only' in args:
+    with open(params['file_base'] + '_nodes.csv', 'w') as f:
+        f.write('0,1,node_synthetic_0,2,1,2\\n')
+    sys.exit(0)
+tables = any(name.endswith(('materials_all_blocks.i', 'materials_hydraulic.i'))
+             for name in inputs)
+generator = {'time': 0.5, 'num_calls': 1}
+jacobian = {'time': 3.0 if tables else 2.0, 'num_calls': 4}
+graph = {'App': {'time': 1.0, 'num_calls': 1,
+                 'MeshGeneratorSystem': {'time': 0.1, 'num_calls': 1,
+                                         'blocks::addLowerDBlocks': generator},
+                 'FEProblem::computeJacobianInternal': jacobian,
+                 'FEProblem::computeResidualInternal': {'time': 1.0, 'num_calls': 8}}}
+memory = [200.0 if tables else 100.0]
+with open(params['out_base'] + '.json', 'w') as f:
+    json.dump({'time_steps': [{'perf_graph': {'graph': graph},
+                               'peak_rss': {'value': max(memory)},
+                               'rank_memory': {'physical_mem': memory}}]}, f)
+if any(name.endswith('hydraulic_check.i') for name in inputs):
+    mismatch = 'FAKE_MISMATCH' in os.environ and inputs[-1].endswith('materials_hydraulic.i')
+    porosity = '0.2' if mismatch else '0.1'
+    with open(params['out_base'] + '_check_elements_0001.csv', 'w') as f:
+        f.write('id,kxx,porosity\\n0,1e-12,%s\\n1,2e-12,0.11\\n' % porosity)
+    with open(params['out_base'] + '_check_nodes_0001.csv', 'w') as f:
+        f.write('id,pp\\n0,1e6\\n')
+if 'Mesh/blocks/verbose=true' in args:
+    print('blocks: added 12 lower-d elements in 2 blocks from 2 sidesets in 1 passes; 2 '
+          'prepare_for_use calls took 0.25 s; exchanged 4096 bytes of boundary data '
+          '(all_ranks) over 2 processes in 0.125 s')
+"""
+
+# Stands in for csv_parse_benchmark
+FAKE_PARSER = """\
+#!/bin/sh
+echo '{"parser": "legacy", "blocks": 1, "node_ids": 2, "best": 0.4, "seconds": [0.4]}'
+echo '{"parser": "mapped", "blocks": 1, "node_ids": 2, "best": 0.1, "seconds": [0.1]}'
+"""
+
+
+class TestParsing(unittest.TestCase):
+    def test_perf_graph(self):
+        data = {'graph': {'App': {'time': 1.0, 'num_calls': 1,
+                                  'a::addLowerDBlocks': {'time': 2.0, 'num_calls': 1,
+                                                         'a::prepareOutput': {'time': 0.5,
+                                                                              'num_calls': 3}}}}}
+        sections = run_benchmarks.perf_graph(data)
+        # A section's time includes the sections it calls
+        self.assertEqual(sections['App']['time'], 3.5)
+        self.assertEqual(sections['a::addLowerDBlocks']['time'], 2.5)
+        self.assertEqual(sections['a::prepareOutput']['calls'], 3)
+        self.assertEqual(run_benchmarks.section(sections, 'prepareOutput'), (0.5, 3))
+
+    def test_lower_d_report(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            log_name = os.path.join(tmp, 'run.log')
+            # What LowerDBlockGeneratorBase::reportLowerDBlocks prints on a replicated mesh
+            with open(log_name, 'w') as log:
+                log.write('blocks: added 7 lower-d elements in 3 blocks from 4 sidesets in 1 '
+                          'passes; 2 prepare_for_use calls took 0.5 s\n')
+            report = run_benchmarks.read_log(log_name)
+            self.assertEqual(report['elements_added'], 7)
+            self.assertEqual(report['sidesets'], 4)
+            self.assertEqual(report['prepare_for_use_calls'], 2)
+            self.assertNotIn('bytes_exchanged', report)
+
+            # and on a distributed mesh
+            with open(log_name, 'w') as log:
+                log.write('blocks: added 7 lower-d elements in 3 blocks from 4 sidesets in 2 '
+                          'passes; 4 prepare_for_use calls took 1e-05 s; exchanged 960 bytes of '
+                          'boundary data (neighbors) over 4 processes in 0.25 s\n')
+            report = run_benchmarks.read_log(log_name)
+            self.assertEqual(report['passes'], 2)
+            self.assertEqual(report['prepare_for_use_time'], 1e-05)
+            self.assertEqual(report['bytes_exchanged'], 960)
+            self.assertEqual(report['exchange'], 'neighbors')
+
+    def test_max_difference(self):
+        reference = {'elements': {'porosity': [0.1, 0.2], 'kxx': [0.0, 1e-12]}}
+        self.assertEqual(run_benchmarks.max_difference(reference, reference), 0.0)
+        changed = {'elements': {'porosity': [0.1, 0.22], 'kxx': [0.0, 1e-12]}}
+        self.assertAlmostEqual(run_benchmarks.max_difference(reference, changed), 0.02 / 0.22)
+        self.assertIsNone(run_benchmarks.max_difference(reference, {}))
+        self.assertIsNone(run_benchmarks.max_difference(
+            reference, {'elements': {'porosity': [0.1], 'kxx': [0.0]}}))
+
+
+class TestDerived(unittest.TestCase):
+    @staticmethod
+    def result(suite, params, ranks, addlowerd_time):
+        return {'build': 'current', 'suite': suite, 'params': params, 'ranks': ranks,
+                'threads': 1, 'mesh': 'distributed', 'returncode': 0,
+                'summary': {'addLowerDBlocks': {'time': addlowerd_time, 'calls': 1}}}
+
+    def test_scaling_efficiency(self):
+        strong = [self.result('scaling', dict(scaling='strong', elements=1000), ranks, time)
+                  for ranks, time in ((1, 8.0), (4, 4.0))]
+        weak = [self.result('scaling', dict(scaling='weak', elements=1000 * ranks), ranks, time)
+                for ranks, time in ((1, 2.0), (4, 4.0))]
+        run_benchmarks.derive_scaling(strong + weak)
+        self.assertEqual(strong[0]['summary']['efficiency'], 1.0)
+        self.assertEqual(strong[1]['summary']['efficiency'], 0.5)
+        self.assertEqual(weak[1]['summary']['efficiency'], 0.5)
+
+
+class TestDriver(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.tmp.cleanup)
+        self.programs = {}
+        for name, text in (('mpiexec', FAKE_MPIEXEC), ('app', FAKE_APP),
+                           ('parser', FAKE_PARSER)):
+            path = os.path.join(self.tmp.name, name)
+            with open(path, 'w') as f:
+                f.write(text)
+            os.chmod(path, os.stat(path).st_mode | stat.S_IEXEC)
+            self.programs[name] = path
+
+    def run_driver(self, *args, env=None):
+        output = os.path.join(self.tmp.name, 'results.json')
+        cmd = [sys.executable, os.path.join(HERE, 'run_benchmarks.py'),
+               '--exec', self.programs['app'], '--mpiexec', self.programs['mpiexec'],
+               '--workdir', os.path.join(self.tmp.name, 'runs'), '--output', output,
+               '--meshes', 'replicated', '--sizes', '1e3'] + list(args)
+        process = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                 universal_newlines=True, env=dict(os.environ, **(env or {})))
+        results = None
+        if os.path.exists(output):
+            with open(output) as f:
+                results = {result['case']: result for result in json.load(f)['results']}
+        return process, results
+
+    def test_generators(self):
+        process, results = self.run_driver('--suite', 'generators', '--ranks', '1', '2')
+        self.assertEqual(process.returncode, 0, process.stdout)
+        # Two generators, two sets of materials and two numbers of processes
+        self.assertEqual(len(results), 8)
+
+        case = results['generators_elements-1000_generator-sidesets_materials-all_blocks_np2'
+                       '_replicated']
+        self.assertIn('-i', case['command'])
+        self.assertIn('Mesh/blocks/verbose=true', case['command'])
+        summary = case['summary']
+        self.assertEqual(summary['addLowerDBlocks'], {'time': 0.5, 'calls': 1})
+        self.assertEqual(summary['bytes_exchanged'], 4096)
+        self.assertEqual(summary['prepare_for_use_calls'], 2)
+        # Against the same case with constant materials
+        self.assertEqual(summary['material_time'], 1.0)
+        self.assertEqual(summary['material_time_per_jacobian'], 0.25)
+        self.assertEqual(summary['material_rank_memory'], [100.0])
+
+    def test_check(self):
+        process, results = self.run_driver('--suite', 'check', '--ranks', '1')
+        self.assertEqual(process.returncode, 0, process.stdout)
+        summary = results['check_elements-1000_materials-hydraulic_np1_replicated']['summary']
+        self.assertTrue(summary['matches'])
+        self.assertEqual(summary['max_relative_difference'], 0.0)
+
+    def test_check_fails_on_a_difference(self):
+        process, results = self.run_driver('--suite', 'check', '--ranks', '1',
+                                           env={'FAKE_MISMATCH': '1'})
+        self.assertEqual(process.returncode, 1, process.stdout)
+        self.assertIn('does not match', process.stdout)
+        summary = results['check_elements-1000_materials-hydraulic_np1_replicated']['summary']
+        self.assertFalse(summary['matches'])
+
+    def test_parser(self):
+        process, results = self.run_driver('--suite', 'parser', '--ranks', '1',
+                                           '--parser-exec', self.programs['parser'])
+        self.assertEqual(process.returncode, 0, process.stdout)
+        (result,) = results.values()
+        self.assertTrue(result['command'][1].endswith('synthetic_nodes.csv'))
+        self.assertEqual(result['summary'], {'legacy': 0.4, 'mapped': 0.1, 'speedup': 4.0})
+
+    def test_dry_run(self):
+        process, results = self.run_driver('--suite', 'scaling', '--ranks', '2', '--dry-run')
+        self.assertEqual(process.returncode, 0, process.stdout)
+        self.assertIsNone(results)
+        self.assertIn('--distributed-mesh', process.stdout)
+        self.assertIn('Mesh/blocks/boundary_element_exchange=neighbors', process.stdout)
+
+
+if __name__ == '__main__':
+    unittest.main()
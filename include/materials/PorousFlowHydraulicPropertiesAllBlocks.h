@@ -0,0 +1,72 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "PorousFlowMaterialVectorBase.h"
+#include "BlockPropertyTable.h"
+
+/**
+ * Material to provide the porosity and, at the quadpoints, the permeability tensor of each block
+ * from one CSV table, where row i holds block i + 1. The permeability is isotropic, diagonal or
+ * full depending on how many columns hold it. Both properties are assumed constant in time.
+ * With a single permeability column it gives the same properties as PorousFlowPorosityAllBlocks
+ * and PorousFlowPermeabilityAllBlocks reading the same columns.
+ */
+template <bool is_ad>
+class PorousFlowHydraulicPropertiesAllBlocksTempl : public PorousFlowMaterialVectorBase
+{
+public:
+  static InputParameters validParams();
+
+  PorousFlowHydraulicPropertiesAllBlocksTempl(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+protected:
+  /// Looks up the properties of the current element's block once for all its points
+  virtual void initStatefulProperties(unsigned int n_points) override;
+  virtual void computeProperties() override;
+
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+  /// Sets the current element's block properties
+  void setElemProperties();
+
+  const FileName & _file_name;
+  /// Block property table shared by every material reading the same file
+  const std::shared_ptr<const BlockPropertyTable> _table;
+  /// Porosity of each block, a view into the shared table
+  const std::vector<Real> & _porosity_data;
+  /// Permeability tensor of each block, built once from the table
+  std::vector<RealTensorValue> _permeability_data;
+
+  /// Porosity of the current element's block
+  Real _elem_porosity;
+  /// Permeability tensor of the current element's block
+  const RealTensorValue * _elem_permeability;
+
+  /// Computed porosity at the nodes or quadpoints
+  GenericMaterialProperty<Real, is_ad> & _porosity;
+  /// d(porosity)/d(PorousFlow variable)
+  MaterialProperty<std::vector<Real>> * const _dporosity_dvar;
+  /// d(porosity)/d(grad(PorousFlow variable))
+  MaterialProperty<std::vector<RealGradient>> * const _dporosity_dgradvar;
+
+  /// Quadpoint permeability, only computed when not at the nodes
+  GenericMaterialProperty<RealTensorValue, is_ad> * const _permeability_qp;
+  /// d(quadpoint permeability)/d(PorousFlow variable)
+  MaterialProperty<std::vector<RealTensorValue>> * const _dpermeability_qp_dvar;
+  /// d(quadpoint permeability)/d(grad(PorousFlow variable))
+  MaterialProperty<std::vector<std::vector<RealTensorValue>>> * const _dpermeability_qp_dgradvar;
+};
+
+typedef PorousFlowHydraulicPropertiesAllBlocksTempl<false> PorousFlowHydraulicPropertiesAllBlocks;
+typedef PorousFlowHydraulicPropertiesAllBlocksTempl<true> ADPorousFlowHydraulicPropertiesAllBlocks;
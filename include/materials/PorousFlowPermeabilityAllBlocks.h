@@ -10,6 +10,7 @@
 #pragma once
 
 #include "PorousFlowPermeabilityBase.h"
+#include "BlockPropertyTable.h"
 #include <string>
 
 /**
@@ -30,12 +31,21 @@ public:
 
   PorousFlowPermeabilityAllBlocksTempl(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
+  /// Builds the permeability tensor of the current element's block and fills all its quadpoints
+  virtual void computeProperties() override;
   void computeQpProperties() override;
 
   const FileName& _file_name;
   const unsigned int& _col_index;
-  std::vector<Real> _permeability_data; // ブロックIDとインデックスの辞書
+  /// Block property table shared by every material reading the same file
+  const std::shared_ptr<const BlockPropertyTable> _table;
+  /// Permeability of each block, a view into the shared table
+  const std::vector<Real> & _permeability_data;
+  /// Permeability tensor of the current element's block
+  RealTensorValue _elem_permeability;
 
 
   usingPorousFlowPermeabilityBaseMembers;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "PorousFlowPorosityBase.h" 
+#include "BlockPropertyTable.h"
 #include <map>
 #include <string>
 
@@ -27,13 +28,24 @@ public:
 
   PorousFlowPorosityAllBlocksTempl(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
+  /// Looks up the porosity of the current element's block once and fills all its quadpoints
+  virtual void initStatefulProperties(unsigned int n_points) override;
+  virtual void computeProperties() override;
+
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
   const FileName& _file_name;
   const unsigned int& _col_index;
-  std::vector<Real> _porosity_data; 
+  /// Block property table shared by every material reading the same file
+  const std::shared_ptr<const BlockPropertyTable> _table;
+  /// Porosity of each block, a view into the shared table
+  const std::vector<Real> & _porosity_data;
+  /// Porosity of the current element's block
+  Real _elem_porosity;
 
   usingPorousFlowPorosityBaseMembers;
 };
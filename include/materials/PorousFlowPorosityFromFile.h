@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "PorousFlowPorosityBase.h"
+
+/**
+ * Material to provide a porosity sampled from a function, typically one reading a data
+ * file. Note: this material assumes that the porosity remains constant throughout a
+ * simulation, so the function is only sampled at t = 1.
+ */
+template <bool is_ad>
+class PorousFlowPorosityFromFileTempl : public PorousFlowPorosityBaseTempl<is_ad>
+{
+public:
+  static InputParameters validParams();
+
+  PorousFlowPorosityFromFileTempl(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+  /// Constant porosity (Real constant Monomial variable only so no AD version)
+  // const VariableValue & _input_porosity;
+  const Function & _func;
+
+  /// Whether the function is sampled once and stored, rather than at every evaluation
+  const bool _cache_values;
+  /// The stored function sample (only with cache_values)
+  MaterialProperty<Real> * const _porosity_sample;
+  /// The stored function sample from the previous step (only with cache_values)
+  const MaterialProperty<Real> * const _porosity_sample_old;
+
+  usingPorousFlowPorosityBaseMembers;
+};
+
+typedef PorousFlowPorosityFromFileTempl<false> PorousFlowPorosityFromFile;
+typedef PorousFlowPorosityFromFileTempl<true> ADPorousFlowPorosityFromFile;
@@ -25,7 +25,13 @@ public:
 
   PorousFlowPorosityMultiBlocksTempl(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
+  /// Looks up the porosity of the current element's block once for all its points
+  virtual void initStatefulProperties(unsigned int n_points) override;
+  virtual void computeProperties() override;
+
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
@@ -35,7 +41,10 @@ protected:
   // const Function & _func;
 
   std::vector<SubdomainID> _block_ids;
-  std::map<SubdomainID, size_t> _block_to_index; // ブロックIDとインデックスの辞書
+  /// Porosity indexed by block ID, NaN for blocks without one
+  std::vector<Real> _block_porosity;
+  /// Porosity of the current element's block
+  Real _elem_porosity;
 
   usingPorousFlowPorosityBaseMembers;
 };
@@ -9,12 +9,12 @@
 
 #pragma once
 
-#include "MeshGenerator.h"
+#include "LowerDBlockGeneratorBase.h"
 
 /*
  * Mesh generator to create a new node set and a new boundary with the nodes the user provides
  */
-class BlockFromNodesGenerator : public MeshGenerator
+class BlockFromNodesGenerator : public LowerDBlockGeneratorBase
 {
 public:
   static InputParameters validParams();
@@ -24,6 +24,15 @@ public:
   std::unique_ptr<MeshBase> generate() override;
 
 protected:
+  /**
+   * Adds the nodes at \p points to the nodesets \p boundary_ids, matching all points against a
+   * KD-tree of the mesh nodes. Errors listing the points no process could match.
+   */
+  void addNodesByKDTree(MeshBase & mesh,
+                        const std::vector<Point> & points,
+                        const std::vector<boundary_id_type> & boundary_ids,
+                        const Real tolerance) const;
+
   /// mesh to modify
   std::unique_ptr<MeshBase> & _input;
 };
@@ -9,12 +9,12 @@
 
 #pragma once
 
-#include "MeshGenerator.h"
+#include "LowerDBlockGeneratorBase.h"
 
 /*
  * Mesh generator to create a new node set and a new boundary with the nodes the user provides
  */
-class BlockFromNodesGeneratorFromFile : public MeshGenerator
+class BlockFromNodesGeneratorFromFile : public LowerDBlockGeneratorBase
 {
 public:
   static InputParameters validParams();
@@ -23,27 +23,25 @@ public:
 
   std::unique_ptr<MeshBase> generate() override;
 
-  std::unique_ptr<MeshBase> 
-  GenerateNodeSet(
-          std::unique_ptr<MeshBase> mesh,
-          const std::vector<unsigned int> &node_ids,
-          const std::vector<BoundaryName> &boundary_name);
-  
-  std::unique_ptr<MeshBase> 
-  GenerateSideSet(
-            std::unique_ptr<MeshBase> mesh);
-  
-  std::unique_ptr<MeshBase>
-  GenerateBlock(
-          std::unique_ptr<MeshBase> mesh,
-          const std::vector<BoundaryName> &boundary_name,
-          const SubdomainName &block_name);
-
 protected:
+  /**
+   * Adds one nodeset per block name, holding the nodes of every row with that name
+   * @return the nodeset id of each row, the same for rows naming the same block
+   */
+  std::vector<boundary_id_type> addNodeSets(MeshBase & mesh) const;
+
+  /**
+   * Adds to each nodeset in \p boundary_ids the element sides whose nodes are all listed for it
+   * in the file. Only the elements that touch a listed node are looked at.
+   */
+  void addSideSets(MeshBase & mesh, const std::vector<boundary_id_type> & boundary_ids) const;
+
   /// mesh to modify
   std::unique_ptr<MeshBase> & _input;
   const FileName & _file_name;
   std::vector<std::string> _block_names;
+  /// The nodes of all the blocks, one block after the other
   std::vector<unsigned int> _node_ids;
+  /// The number of nodes of each block
   std::vector<unsigned int> _node_offsets;
 };
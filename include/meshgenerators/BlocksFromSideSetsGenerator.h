@@ -9,12 +9,12 @@
 
 #pragma once
 
-#include "MeshGenerator.h"
+#include "LowerDBlockGeneratorBase.h"
 
 /**
  * Creates lower-dimensional elements on the specified sidesets
  */
-class BlocksFromSideSetsGenerator : public MeshGenerator
+class BlocksFromSideSetsGenerator : public LowerDBlockGeneratorBase
 {
 public:
   static InputParameters validParams();
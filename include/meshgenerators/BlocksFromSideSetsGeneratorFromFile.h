@@ -9,12 +9,12 @@
 
 #pragma once
 
-#include "MeshGenerator.h"
+#include "LowerDBlockGeneratorBase.h"
 
 /**
  * Creates lower-dimensional elements on the specified sidesets
  */
-class BlocksFromSideSetsGeneratorFromFile : public MeshGenerator
+class BlocksFromSideSetsGeneratorFromFile : public LowerDBlockGeneratorBase
 {
 public:
   static InputParameters validParams();
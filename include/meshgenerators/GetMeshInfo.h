@@ -12,7 +12,8 @@
 #include "MeshGenerator.h"
 
 /**
- * Creates lower-dimensional elements on the specified sidesets
+ * Writes the connectivity, and in binary format the element, node and boundary data, of the mesh
+ * to a file, leaving the mesh unchanged
  */
 class GetMeshInfo : public MeshGenerator
 {
@@ -24,6 +25,20 @@ public:
   std::unique_ptr<MeshBase> generate() override;
 
 protected:
+  /// Writes the node ids of every element as text, from the first process
+  void writeText(const MeshBase & mesh) const;
+
+  /**
+   * Writes the mesh data owned by each process in columns: a text header with the columns and the
+   * number of elements in each block and of sides and nodes in each boundary, then the binary
+   * columns one after the other
+   */
+  void writeBinary(const MeshBase & mesh) const;
+
   std::unique_ptr<MeshBase> & _input;
   const FileName& _file_name;
+  /// Text or binary output
+  const MooseEnum _format;
+  /// Whether the binary output is one file or one per process
+  const MooseEnum _layout;
 };
@@ -0,0 +1,86 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MeshGenerator.h"
+#include "MeshCache.h"
+
+/**
+ * Base class for mesh generators that create lower-dimensional blocks on sidesets
+ */
+class LowerDBlockGeneratorBase : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  /// Parameters of the generators that can cache the mesh they generate
+  static InputParameters meshCacheParams();
+
+  LowerDBlockGeneratorBase(const InputParameters & parameters);
+
+protected:
+  /**
+   * Adds one lower-dimensional block per entry of \p block_names, made of the sides in the
+   * sidesets \p sideset_names[i]. The side list is built and exchanged once and the mesh is
+   * prepared once, however many blocks are added. The new subdomain ids and block names are the
+   * same as adding the blocks one at a time in order, and so are the element ids unless the
+   * 'neighbors' exchange numbers them by owning process.
+   * @return the subdomain id given to each new block
+   */
+  std::vector<SubdomainID>
+  addLowerDBlocks(MeshBase & mesh,
+                  const std::vector<std::vector<BoundaryName>> & sideset_names,
+                  const std::vector<SubdomainName> & block_names) const;
+
+  /**
+   * When verbose, prints the totals of the addLowerDBlocks() calls made since the last report,
+   * reduced over the processes of \p mesh once. Called at the end of generate().
+   */
+  void reportLowerDBlocks(const MeshBase & mesh) const;
+
+  /**
+   * The cache for the generated mesh, already keyed with this generator's type and exchange
+   * settings, or nullptr if 'mesh_cache_directory' is not set. Only generators that add
+   * meshCacheParams() call this.
+   */
+  std::unique_ptr<MeshCache> buildMeshCache() const;
+
+  /// How boundary elements are shared between processes on a distributed mesh
+  const MooseEnum _boundary_element_exchange;
+  /// Whether to report the blocks added and the boundary element exchange once generated
+  const bool _verbose;
+
+private:
+  /// Totals of the addLowerDBlocks() calls, local to this process until reported
+  struct LowerDBlockStats
+  {
+    unsigned int n_calls = 0;
+    std::size_t n_blocks = 0;
+    std::size_t n_sidesets = 0;
+    /// Lower-d elements owned by this process
+    dof_id_type n_added = 0;
+    unsigned int n_prepare = 0;
+    Real prepare_time = 0;
+    std::size_t bytes_sent = 0;
+    Real exchange_time = 0;
+    bool distributed = false;
+  };
+  mutable LowerDBlockStats _stats;
+
+  /**
+   * Sends every locally owned element on the sidesets in \p sideset_to_blocks, with its nodes, to
+   * every process that has any of these sidesets
+   * @return the number of bytes sent, only counted when verbose
+   */
+  std::size_t
+  gatherBoundaryElements(MeshBase & mesh,
+                         const std::map<boundary_id_type, std::vector<std::size_t>> &
+                             sideset_to_blocks) const;
+};
@@ -0,0 +1,41 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+/**
+ * Adds synthetic sidesets to a mesh and writes the matching input files of the FromFile block
+ * generators and of the AllBlocks materials, to benchmark them on meshes of any size
+ */
+class SyntheticBlockDataGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  SyntheticBlockDataGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// mesh to modify
+  std::unique_ptr<MeshBase> & _input;
+  /// The number of sidesets and node lists to make
+  const unsigned int _num_blocks;
+  /// One element in this many gives a side to a sideset
+  const unsigned int _element_period;
+  /// The number of subdomains to spread the elements over, or 0 to keep their subdomains
+  const unsigned int _num_subdomains;
+  /// The files are named <file_base>_sidesets.csv, <file_base>_nodes.csv and
+  /// <file_base>_properties.csv
+  const std::string _file_base;
+  /// Prefix of the sideset and node list names, followed by the block number
+  const std::string _prefix;
+};
@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class MappedCSVFile;
+
+/**
+ * The blocks to create from node lists, as read from a CSV file where each row holds whether to
+ * create the block in column 1, the block name, and the number of nodes followed by the node ids.
+ * Blank rows and rows with a zero in column 1 are skipped.
+ */
+struct BlockNodeLists
+{
+  /**
+   * Reads the node lists of \p csv, taking the block name from column \p block_col_index and the
+   * number of nodes from column \p node_offset_col_index. Errors, with the line number, on a row
+   * too short for its block name or node ids.
+   */
+  static BlockNodeLists
+  read(const MappedCSVFile & csv, unsigned int block_col_index, unsigned int node_offset_col_index);
+
+  /// The name of each block
+  std::vector<std::string> block_names;
+  /// The nodes of all the blocks, one block after the other
+  std::vector<unsigned int> node_ids;
+  /// The number of nodes of each block
+  std::vector<unsigned int> node_offsets;
+};
@@ -0,0 +1,77 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+class MooseObject;
+
+/**
+ * Read-only table of block properties read from a CSV file, where row i holds the values for
+ * block i + 1. A file is parsed once per process: every material (and every thread copy of it)
+ * that reads the same file shares the same table until the file changes on disk.
+ */
+class BlockPropertyTable
+{
+public:
+  /**
+   * Returns the table for \p file_name, parsing the file only if no table is loaded for it or the
+   * file was modified since it was loaded. With a communicator, all its processes must call this
+   * together and only the first one reads the file.
+   */
+  static std::shared_ptr<const BlockPropertyTable>
+  get(const FileName & file_name, const Parallel::Communicator * comm = nullptr);
+
+  /**
+   * Returns the table for \p file_name as above, on the processes of \p object, timing it in the
+   * application's perf graph
+   */
+  static std::shared_ptr<const BlockPropertyTable> get(const MooseObject & object,
+                                                       const FileName & file_name);
+
+  /// The file the table was read from
+  const FileName & fileName() const { return _file_name; }
+
+  /// The number of rows, i.e. blocks, in the table
+  std::size_t numRows() const { return _num_rows; }
+
+  /**
+   * The values of column \p col, one per row. Errors if any row has no number in this column.
+   */
+  const std::vector<Real> & column(unsigned int col) const;
+
+  /**
+   * Errors, on the file_name parameter of \p object, if the table has no row for one of
+   * \p blocks
+   */
+  void checkBlocks(const MooseObject & object, const std::set<SubdomainID> & blocks) const;
+
+private:
+  BlockPropertyTable(const FileName & file_name, const Parallel::Communicator * comm);
+
+  /// The file the table was read from
+  const FileName _file_name;
+
+  /// The number of rows in the file
+  std::size_t _num_rows;
+
+  /// The values, column by column
+  std::vector<std::vector<Real>> _columns;
+
+  /// For each column, the first line (counted from 1) without a number in it, or 0 if none
+  std::vector<std::size_t> _first_invalid_line;
+};
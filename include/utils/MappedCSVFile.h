@@ -0,0 +1,136 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+
+#include "libmesh/parallel.h"
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Comma separated file split into rows (one per line, blank lines included) and fields without
+ * copying them. The file is memory mapped, a UTF-8 byte order mark is skipped, line endings may be
+ * LF or CRLF and trailing blanks are stripped from every field. A trailing comma does not start an
+ * empty field.
+ *
+ * When a communicator is given, only its first process reads the file and broadcasts the bytes, so
+ * that the others do not touch the file system.
+ */
+class MappedCSVFile
+{
+public:
+  MappedCSVFile(const std::string & file_name, const Parallel::Communicator * comm = nullptr);
+  ~MappedCSVFile();
+
+  MappedCSVFile(const MappedCSVFile &) = delete;
+  MappedCSVFile & operator=(const MappedCSVFile &) = delete;
+
+  /// The file that was read
+  const std::string & fileName() const { return _file_name; }
+
+  /// The number of rows, i.e. lines, in the file
+  std::size_t numRows() const { return _row_begin.size() - 1; }
+
+  /// The number of fields in row \p row
+  std::size_t numFields(std::size_t row) const { return _row_begin[row + 1] - _row_begin[row]; }
+
+  /// Field \p col of row \p row, which must exist
+  std::string_view field(std::size_t row, std::size_t col) const
+  {
+    return _fields[_row_begin[row] + col];
+  }
+
+  /**
+   * Parses \p field, ignoring leading blanks and a leading '+', into \p value
+   * @return whether the whole field is a number of type T
+   */
+  template <typename T>
+  static bool parse(std::string_view field, T & value);
+
+  /**
+   * Field \p col of row \p row as a number of type T. Errors, with the line number, if the row is
+   * too short or the field is not a number.
+   */
+  template <typename T>
+  T value(std::size_t row, std::size_t col) const;
+
+  /// Errors with the file name and the line number of row \p row in front of \p args
+  template <typename... Args>
+  [[noreturn]] void error(std::size_t row, Args &&... args) const;
+
+private:
+  /// Maps the file into _data, or reads it into _buffer when it cannot be mapped
+  bool read();
+
+  /// Splits _data into _fields and _row_begin
+  void split();
+
+  /// The file that was read
+  const std::string _file_name;
+
+  /// The file contents, viewing either the mapping or _buffer
+  std::string_view _data;
+
+  /// Start and length of the memory mapping, if any
+  void * _map;
+  std::size_t _map_size;
+
+  /// The file contents when they were broadcast rather than mapped
+  std::string _buffer;
+
+  /// All fields, row after row
+  std::vector<std::string_view> _fields;
+
+  /// Index in _fields of the first field of each row, followed by the number of fields
+  std::vector<std::size_t> _row_begin;
+};
+
+template <typename T>
+bool
+MappedCSVFile::parse(std::string_view field, T & value)
+{
+  static_assert(std::is_arithmetic<T>::value, "MappedCSVFile only parses numbers");
+
+  const auto first = field.find_first_not_of(" \t");
+  if (first == std::string_view::npos)
+    return false;
+  field.remove_prefix(first);
+  if (field.size() > 1 && field[0] == '+' && field[1] != '-')
+    field.remove_prefix(1);
+
+  const char * const end = field.data() + field.size();
+  const auto [ptr, ec] = std::from_chars(field.data(), end, value);
+  return ec == std::errc() && ptr == end;
+}
+
+template <typename T>
+T
+MappedCSVFile::value(std::size_t row, std::size_t col) const
+{
+  if (col >= numFields(row))
+    error(row, "expected at least ", col + 1, " fields but found ", numFields(row));
+
+  T value;
+  if (!parse(field(row, col), value))
+    error(row, "field ", col, " '", field(row, col), "' is not a valid number");
+  return value;
+}
+
+template <typename... Args>
+void
+MappedCSVFile::error(std::size_t row, Args &&... args) const
+{
+  mooseError(_file_name, ":", row + 1, ": ", std::forward<Args>(args)...);
+}
@@ -0,0 +1,120 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ConsoleStream.h"
+#include "MooseTypes.h"
+
+#include "libmesh/mesh_base.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * On-disk cache of the mesh a generator makes from its input mesh. The cache key hashes the input
+ * mesh (nodes, elements, subdomains, boundaries and their names) together with whatever else the
+ * generator adds to inputs(), so a cached mesh is only reused when all of them are unchanged.
+ *
+ * Meshes are stored as binary libMesh checkpoints, plus the interior parent of every element that
+ * has one, which checkpoints do not keep. Meshes that are serial when stored are kept in one
+ * file, the others in one file per process; each entry records which. Entries for meshes that are
+ * not replicated are only reused with the same number of processes.
+ */
+class MeshCache
+{
+public:
+  /// 64-bit FNV-1a hash
+  class Hash
+  {
+  public:
+    Hash() : _value(14695981039346656037ULL) {}
+
+    void add(const void * data, std::size_t size)
+    {
+      const auto * bytes = static_cast<const unsigned char *>(data);
+      for (std::size_t i = 0; i < size; ++i)
+        _value = (_value ^ bytes[i]) * 1099511628211ULL;
+    }
+
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+    void add(const T & value)
+    {
+      add(&value, sizeof(T));
+    }
+
+    void add(const std::string & value)
+    {
+      add(value.size());
+      add(value.data(), value.size());
+    }
+
+    template <typename T>
+    void add(const std::vector<T> & values)
+    {
+      add(values.size());
+      for (const auto & value : values)
+        add(value);
+    }
+
+    std::uint64_t value() const { return _value; }
+
+  private:
+    std::uint64_t _value;
+  };
+
+  /**
+   * @param directory where the cached meshes are kept, created if needed
+   * @param name a name for the generator, used in the file names and messages
+   */
+  MeshCache(const std::string & directory,
+            const std::string & name,
+            const ConsoleStream & console,
+            const Parallel::Communicator & comm);
+
+  /// The generator inputs, other than the input mesh, that the generated mesh depends on
+  Hash & inputs() { return _inputs; }
+
+  /**
+   * Looks for the mesh generated from \p mesh and inputs(). On a hit \p mesh is replaced by the
+   * cached mesh, prepared for use.
+   * @return whether the cache had the mesh
+   */
+  bool load(MeshBase & mesh);
+
+  /// Stores \p mesh, the mesh generated after load() missed, for later runs
+  void store(const MeshBase & mesh);
+
+  /**
+   * Hash of \p mesh that does not depend on how it is partitioned or in what order its elements
+   * and nodes are stored
+   */
+  static std::uint64_t hashMesh(const MeshBase & mesh);
+
+private:
+  /// The checkpoint directory for the current key
+  std::string checkpointName() const;
+
+  const std::string _directory;
+  const std::string _name;
+  const ConsoleStream & _console;
+  const Parallel::Communicator & _comm;
+
+  /// Hash of the generator inputs
+  Hash _inputs;
+
+  /// The key of the last load(), in hexadecimal
+  std::string _key;
+
+  /// When the last load() missed, to report the generation time
+  std::chrono::steady_clock::time_point _miss_time;
+};
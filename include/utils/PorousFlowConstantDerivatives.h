@@ -0,0 +1,33 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * Derivatives of PorousFlow properties that do not depend on the PorousFlow variables, such as
+ * block-constant porosity or permeability
+ */
+namespace PorousFlowConstantDerivatives
+{
+/**
+ * Sets the derivatives of a scalar property at one point to zero for \p num_var variables. The
+ * derivative properties are shared by every material supplying the property on any block, so they
+ * are set on every call: a material on another block may have left nonzero values in them.
+ */
+void zero(std::vector<Real> & dvar, std::vector<RealGradient> & dgradvar, unsigned int num_var);
+
+/// Sets the derivatives of a tensor property at one point to zero, as above
+void zero(std::vector<RealTensorValue> & dvar,
+          std::vector<std::vector<RealTensorValue>> & dgradvar,
+          unsigned int num_var);
+}